@@ -16,6 +16,14 @@
 #include <unistd.h>
 #include <locale.h>
 #include <wchar.h>
+#include <string.h>
+#include <pthread.h>
+#include <errno.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
 
 #define DELAY 100000
 #define INITIAL_SPEED DELAY
@@ -28,6 +36,16 @@
 #define MAX_OBSTACLES 15
 #define BONUS_FOOD_CHANCE 20  // 1 in 20 chance for bonus food
 #define BONUS_DURATION 30     // Bonus food stays for 30 cycles
+#define BOARD_CELLS (GAME_WIDTH * GAME_HEIGHT)
+#define LINKS_PER_WORD 32     // 64 bitlik kelimeye sığan 2 bitlik yön sayısı
+#define LINK_WORDS(n) (((n) + LINKS_PER_WORD - 1) / LINKS_PER_WORD)
+#define OCCUPANCY_WORDS ((BOARD_CELLS + 63) / 64)  // Hücre başına 1 bit
+
+// Planlayıcı (otomatik pilot) ayarları
+#define PLANNER_MAX_THREADS 16
+#define PLANNER_DEPTH 40           // Her rollout'un en fazla tik sayısı
+#define PLANNER_BUDGET_PERCENT 80  // Tik süresinin planlamaya ayrılan yüzdesi
+#define PLANNER_DEATH_PENALTY 200.0 // Can kaybının puan cinsinden cezası
 
 // Emojiler
 #define SNAKE_HEAD L"🐍"
@@ -68,10 +86,24 @@ typedef enum {
     RIGHT
 } Direction;
 
+// Yılan gövdesi: baş ve kuyruk koordinatları ile her parça arasındaki yön,
+// 64 bitlik kelimelere 2 bit olarak paketlenmiş halka tamponda tutulur.
+// Çizim ve çarpışma gövdeyi dolaşmaz, hücre başına 1 bitlik doluluk
+// ızgarasına bakar
 typedef struct {
-    Point *body;
+    Point head;
+    Point tail;
+    unsigned long long *links;  // Kuyruktan başa doğru parçalar arası yönler
+    int first_link;             // Halka tamponda kuyruğa ait bağlantının yeri
     int length;
-    int max_length;
+    int max_length;             // Halka tamponun bağlantı kapasitesi
+    int growth;                 // Kuyrukta bekleyen, henüz açılmamış parça sayısı
+    int self_hit;               // Son harekette baş dolu bir hücreye girdi
+    unsigned long long occupancy[OCCUPANCY_WORDS];
+} SnakeBody;
+
+typedef struct {
+    SnakeBody body;
     Direction direction;
     Direction next_direction;
     int speed;
@@ -87,12 +119,109 @@ typedef struct {
     int paused;
 } GameState;
 
+// Planlayıcının oynattığı, oyunun tam kopyası
+typedef struct {
+    SnakeBody body;
+    unsigned long long link_storage[LINK_WORDS(BOARD_CELLS)];
+    Direction direction;
+    int lives;
+    Food foods[MAX_FOOD];
+    Obstacle obstacles[MAX_OBSTACLES];
+    int obstacle_count;
+    int score;
+    int level;
+    Difficulty difficulty;
+    unsigned int rng;             // sim_clone() kopyalamaz, her rollout başında tohumlanır
+} SimState;
+
+// Her iş parçacığına önceden ayrılan çalışma alanı. Önbellek satırına
+// hizalanır ki komşu alanlar aynı satırı paylaşmasın (false sharing)
+typedef struct {
+    _Alignas(64) pthread_t thread;
+    SimState work;
+    unsigned int rng;
+    double value_sum[4];
+    long visits[4];
+    long nodes;
+} PlannerArena;
+
+typedef struct {
+    int enabled;
+    int thread_count;
+    PlannerArena *arenas;
+    SimState root;
+    Direction candidates[3];
+    int candidate_count;
+    struct timespec deadline;
+    
+    // İş parçacıkları bir kez başlatılır, her tik yeni bir nesil ile uyandırılır
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;
+    pthread_cond_t work_done;
+    long generation;
+    int pending;
+    int shutdown;
+    
+    // İstatistikler
+    long ticks;
+    long total_nodes;
+    double total_seconds;
+    double quality_sum;
+    double last_nodes_per_sec;
+    double last_quality;
+} Planner;
+
+// Profil modunda ölçülen oyun döngüsü aşamaları
+typedef enum {
+    PHASE_PLAN,
+    PHASE_UPDATE,
+    PHASE_DRAW,
+    PHASE_REFRESH,
+    PHASE_COUNT
+} ProfilePhase;
+
+typedef enum {
+    COUNTER_CYCLES,
+    COUNTER_INSTRUCTIONS,
+    COUNTER_CACHE_MISSES,
+    COUNTER_BRANCH_MISSES,
+    COUNTER_COUNT
+} ProfileCounter;
+
+typedef struct {
+    unsigned long long time_enabled;
+    unsigned long long time_running;  // Çoğullamada time_enabled'dan küçük olur
+    unsigned long long values[COUNTER_COUNT];
+} ProfileSample;
+
+typedef struct {
+    long calls;
+    long sampled;                     // Sayaçların gerçekten çalıştığı çağrılar
+    int multiplexed;                  // En az bir ölçüm ölçeklendi
+    double seconds;
+    unsigned long long counters[COUNTER_COUNT];
+} PhaseStats;
+
+typedef struct {
+    int enabled;
+    int group_fd;                     // -1 ise sadece saat ile ölçülür
+    int fds[COUNTER_COUNT];
+    int slots[COUNTER_COUNT];         // Grup okumasındaki sıra, -1 = sayaç yok
+    int slot_count;
+    int open_error;                   // Sayaçlar açılamadıysa errno
+    struct timespec start;
+    ProfileSample start_sample;
+    PhaseStats phases[PHASE_COUNT];
+} Profiler;
+
 // Oyun bileşenleri
 Snake snake;
 Food foods[MAX_FOOD];
 Obstacle obstacles[MAX_OBSTACLES];
 GameState state;
 int obstacle_count = 0;
+Planner planner;
+Profiler profiler;
 
 // Fonksiyon prototipleri
 void init_game();
@@ -118,10 +247,61 @@ void set_difficulty(Difficulty diff);
 void add_score(int value);
 void draw_background();
 void cleanup_ncurses();
+Direction link_get(const unsigned long long *links, int slot);
+void link_set(unsigned long long *links, int slot, Direction dir);
+Direction body_link(const SnakeBody *body, int index);
+void body_set_link(SnakeBody *body, int index, Direction dir);
+int body_occupies(const SnakeBody *body, int x, int y);
+void body_mark(SnakeBody *body, int x, int y, int occupied);
+void body_reset(SnakeBody *body);
+void body_advance(SnakeBody *body, Direction dir);
+void body_grow(SnakeBody *body);
+void grow_snake_capacity();
+Point next_position(Point p, Direction dir);
+Direction opposite_direction(Direction dir);
+unsigned int sim_rand(unsigned int *rng);
+double elapsed_seconds(struct timespec start, struct timespec end);
+void planner_init();
+void planner_cleanup();
+int planner_choose_move();
+void planner_report();
+void sim_clone(SimState *dst);
+void sim_copy(SimState *dst, const SimState *src);
+void sim_reset_snake(SimState *s);
+void sim_spawn_food(SimState *s, int index);
+int sim_is_blocked(const SimState *s, Point p);
+int sim_step(SimState *s, Direction dir);
+double sim_rollout(SimState *s, Direction first, unsigned int *rng, long *nodes);
+void planner_search(PlannerArena *arena);
+void *planner_worker(void *arg);
+void profile_init();
+void profile_cleanup();
+void profile_read(ProfileSample *sample);
+int profile_counts_phase(ProfilePhase phase);
+void profile_begin(ProfilePhase phase);
+void profile_end(ProfilePhase phase);
+void profile_report();
 
-int main() {
+int main(int argc, char *argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--planner") == 0) {
+            planner.enabled = 1;
+        } else if (strcmp(argv[i], "--profile") == 0) {
+            profiler.enabled = 1;
+        } else {
+            fprintf(stderr, "Kullanım: %s [--planner] [--profile]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    
     setlocale(LC_ALL, "");
     init_game();
+    if (planner.enabled) {
+        planner_init();
+    }
+    if (profiler.enabled) {
+        profile_init();
+    }
     
     show_menu();
     initialize_snake();
@@ -131,9 +311,19 @@ int main() {
     }
     
     while (!state.game_over) {
+        int delay = snake.speed;
+        
         if (!state.paused) {
             handle_input();
+            if (planner.enabled && !state.game_over) {
+                // Planlama süresi tik süresinden düşülür
+                profile_begin(PHASE_PLAN);
+                delay -= planner_choose_move();
+                profile_end(PHASE_PLAN);
+            }
+            profile_begin(PHASE_UPDATE);
             update_game();
+            profile_end(PHASE_UPDATE);
         } else {
             mvprintw(GAME_HEIGHT / 2, (GAME_WIDTH - 16) / 2, "OYUN DURAKLATILDI");
             mvprintw(GAME_HEIGHT / 2 + 1, (GAME_WIDTH - 22) / 2, "Devam etmek için P'ye basın");
@@ -144,11 +334,19 @@ int main() {
         }
         
         draw_game();
-        usleep(snake.speed);
+        if (delay > 0) {
+            usleep(delay);
+        }
     }
     
     show_game_over();
     end_game();
+    if (planner.enabled) {
+        planner_report();
+    }
+    if (profiler.enabled) {
+        profile_report();
+    }
     return 0;
 }
 
@@ -192,15 +390,17 @@ void cleanup_ncurses() {
 }
 
 void end_game() {
-    free(snake.body);
-    snake.body = NULL;
+    free(snake.body.links);
+    snake.body.links = NULL;
+    planner_cleanup();
+    profile_cleanup();
     cleanup_ncurses();
 }
 
 void reset_game() {
     // Önceki yılanı temizle
-    free(snake.body);
-    snake.body = NULL;
+    free(snake.body.links);
+    snake.body.links = NULL;
     
     state.score = 0;
     state.level = 1;
@@ -218,85 +418,191 @@ void reset_game() {
 }
 
 void initialize_snake() {
-    snake.max_length = 100;  // Başlangıçta 100 segment için yer ayır
-    snake.body = malloc(snake.max_length * sizeof(Point));
-    if (snake.body == NULL) {
+    snake.body.max_length = LINK_WORDS(100) * LINKS_PER_WORD;  // Başlangıçta ~100 segment için yer ayır
+    snake.body.links = malloc(LINK_WORDS(snake.body.max_length) * sizeof(unsigned long long));
+    if (snake.body.links == NULL) {
         endwin();
         fprintf(stderr, "Memory allocation error for snake body\n");
         exit(EXIT_FAILURE);
     }
     
-    snake.length = INITIAL_LENGTH;
     snake.direction = RIGHT;
     snake.next_direction = RIGHT;
-    
+    body_reset(&snake.body);
+}
+
+// Paketlenmiş tamponda slot'taki 2 bitlik yönü oku/yaz
+Direction link_get(const unsigned long long *links, int slot) {
+    return (Direction)((links[slot / LINKS_PER_WORD] >> (slot % LINKS_PER_WORD * 2)) & 3);
+}
+
+void link_set(unsigned long long *links, int slot, Direction dir) {
+    int shift = slot % LINKS_PER_WORD * 2;
+    unsigned long long *word = &links[slot / LINKS_PER_WORD];
+    *word = (*word & ~(3ULL << shift)) | ((unsigned long long)dir << shift);
+}
+
+// Halka tamponda kuyruktan itibaren index'inci bağlantı
+Direction body_link(const SnakeBody *body, int index) {
+    return link_get(body->links, (body->first_link + index) % body->max_length);
+}
+
+void body_set_link(SnakeBody *body, int index, Direction dir) {
+    link_set(body->links, (body->first_link + index) % body->max_length, dir);
+}
+
+int body_occupies(const SnakeBody *body, int x, int y) {
+    int cell = y * GAME_WIDTH + x;
+    return (body->occupancy[cell / 64] >> (cell % 64)) & 1;
+}
+
+void body_mark(SnakeBody *body, int x, int y, int occupied) {
+    int cell = y * GAME_WIDTH + x;
+    if (occupied) {
+        body->occupancy[cell / 64] |= 1ULL << (cell % 64);
+    } else {
+        body->occupancy[cell / 64] &= ~(1ULL << (cell % 64));
+    }
+}
+
+// Yılanı başlangıç konumuna yerleştir (links tamponu ayrılmış olmalı)
+void body_reset(SnakeBody *body) {
     // Yılanın başlangıç pozisyonu
     int center_x = GAME_WIDTH / 4;  // Sol tarafa doğru başlat
     int center_y = GAME_HEIGHT / 2;
     
-    // Başlangıçta yılanın tüm parçalarını belirli konumlara yerleştir
-    for (int i = 0; i < snake.length; i++) {
-        snake.body[i].x = center_x - i;
-        snake.body[i].y = center_y;
+    memset(body->occupancy, 0, sizeof(body->occupancy));
+    body->length = INITIAL_LENGTH;
+    body->growth = 0;
+    body->self_hit = 0;
+    body->first_link = 0;
+    body->head.x = center_x;
+    body->head.y = center_y;
+    body->tail.x = center_x - (INITIAL_LENGTH - 1);
+    body->tail.y = center_y;
+    
+    // Başlangıçta yılanın tüm parçaları yatay bir çizgide, sağa bakar
+    for (int i = 0; i < INITIAL_LENGTH; i++) {
+        body_mark(body, center_x - i, center_y, 1);
+    }
+    for (int i = 0; i < INITIAL_LENGTH - 1; i++) {
+        body_set_link(body, i, RIGHT);
+    }
+}
+
+// Başı bir adım ilerlet; büyüme beklemiyorsa kuyruğu da çek.
+// Kuyruk önce boşaltıldığı için baş, az önce boşalan hücreye girebilir.
+// Baş zaten dolu bir hücreye girerse self_hit işaretlenir
+void body_advance(SnakeBody *body, Direction dir) {
+    int links = body->length - 1 - body->growth;
+    
+    if (body->growth > 0) {
+        body->growth--;
+    } else {
+        body_mark(body, body->tail.x, body->tail.y, 0);
+        body->tail = next_position(body->tail, body_link(body, 0));
+        body->first_link = (body->first_link + 1) % body->max_length;
+        links--;
+    }
+    
+    body_set_link(body, links, dir);
+    body->head = next_position(body->head, dir);
+    body->self_hit = body_occupies(body, body->head.x, body->head.y);
+    body_mark(body, body->head.x, body->head.y, 1);
+}
+
+// Yeni parça kuyrukta bekler ve sonraki hareketlerde açılır
+void body_grow(SnakeBody *body) {
+    body->length++;
+    body->growth++;
+}
+
+// Halka tamponun kapasitesini iki katına çıkar
+void grow_snake_capacity() {
+    int links = snake.body.length - 1 - snake.body.growth;
+    int new_max = snake.body.max_length * 2;
+    unsigned long long *new_links = calloc(LINK_WORDS(new_max), sizeof(unsigned long long));
+    if (new_links == NULL) {
+        free(snake.body.links);  // Ayırma başarısız olursa eski belleği temizle
+        endwin();
+        fprintf(stderr, "Memory allocation error during snake growth\n");
+        exit(EXIT_FAILURE);
+    }
+    
+    // Bağlantıları kuyruktan başlayarak yeni tampona sırayla kopyala
+    for (int i = 0; i < links; i++) {
+        link_set(new_links, i, body_link(&snake.body, i));
     }
+    
+    free(snake.body.links);
+    snake.body.links = new_links;
+    snake.body.first_link = 0;
+    snake.body.max_length = new_max;
 }
 
 void draw_snake() {
     // Yılanın başını çiz
     attron(COLOR_PAIR(1));
-    mvaddwstr(snake.body[0].y, snake.body[0].x * 2, SNAKE_HEAD);
+    mvaddwstr(snake.body.head.y, snake.body.head.x * 2, SNAKE_HEAD);
     
-    // Yılanın gövdesini çiz
-    for (int i = 1; i < snake.length; i++) {
-        if (snake.body[i].x >= 0 && snake.body[i].x < GAME_WIDTH &&
-            snake.body[i].y >= 1 && snake.body[i].y < GAME_HEIGHT - 1) {
-            mvaddwstr(snake.body[i].y, snake.body[i].x * 2, SNAKE_BODY);
+    // Yılanın gövdesini doluluk ızgarasından çiz
+    for (int y = 1; y < GAME_HEIGHT - 1; y++) {
+        for (int x = 1; x < GAME_WIDTH - 1; x++) {
+            if (body_occupies(&snake.body, x, y) &&
+                (x != snake.body.head.x || y != snake.body.head.y)) {
+                mvaddwstr(y, x * 2, SNAKE_BODY);
+            }
         }
     }
     attroff(COLOR_PAIR(1));
 }
 
-void move_snake() {
-    // Yönü güncelle
-    snake.direction = snake.next_direction;
-    
-    // Yeni baş pozisyonunu kaydet
-    Point new_head = snake.body[0];
-    
-    // Yılanın başını hareket ettir
-    switch (snake.direction) {
+// Verilen yönde bir adım sonraki pozisyonu hesapla
+Point next_position(Point p, Direction dir) {
+    switch (dir) {
         case UP:
-            new_head.y--;
+            p.y--;
             break;
         case DOWN:
-            new_head.y++;
+            p.y++;
             break;
         case LEFT:
-            new_head.x--;
+            p.x--;
             break;
         case RIGHT:
-            new_head.x++;
+            p.x++;
             break;
     }
     
     // Ekran sınırlarından geçiş
-    if (new_head.x < 1)
-        new_head.x = GAME_WIDTH - 2;
-    else if (new_head.x >= GAME_WIDTH - 1)
-        new_head.x = 1;
+    if (p.x < 1)
+        p.x = GAME_WIDTH - 2;
+    else if (p.x >= GAME_WIDTH - 1)
+        p.x = 1;
         
-    if (new_head.y < 1)
-        new_head.y = GAME_HEIGHT - 2;
-    else if (new_head.y >= GAME_HEIGHT - 1)
-        new_head.y = 1;
+    if (p.y < 1)
+        p.y = GAME_HEIGHT - 2;
+    else if (p.y >= GAME_HEIGHT - 1)
+        p.y = 1;
     
-    // Yılanın gövdesini hareket ettir (tüm gövde parçaları bir öncekinin pozisyonunu alır)
-    for (int i = snake.length - 1; i > 0; i--) {
-        snake.body[i] = snake.body[i - 1];
+    return p;
+}
+
+Direction opposite_direction(Direction dir) {
+    switch (dir) {
+        case UP: return DOWN;
+        case DOWN: return UP;
+        case LEFT: return RIGHT;
+        default: return LEFT;
     }
+}
+
+void move_snake() {
+    // Yönü güncelle
+    snake.direction = snake.next_direction;
     
-    // Yeni baş pozisyonunu ekle
-    snake.body[0] = new_head;
+    // Başı ilerlet, kuyruğu çek
+    body_advance(&snake.body, snake.direction);
 }
 
 void initialize_foods() {
@@ -314,14 +620,7 @@ void spawn_food(int index) {
         foods[index].position.y = rand() % (GAME_HEIGHT - 4) + 2;
         
         // Yılanın üzerinde mi kontrol et
-        int on_snake = 0;
-        for (int i = 0; i < snake.length; i++) {
-            if (foods[index].position.x == snake.body[i].x && 
-                foods[index].position.y == snake.body[i].y) {
-                on_snake = 1;
-                break;
-            }
-        }
+        int on_snake = body_occupies(&snake.body, foods[index].position.x, foods[index].position.y);
         
         // Engellerin üzerinde mi kontrol et
         int on_obstacle = 0;
@@ -384,11 +683,12 @@ void spawn_obstacles() {
             
             // Yılanın etrafında boşluk bırak
             int near_snake = 0;
-            for (int j = 0; j < snake.length; j++) {
-                if (abs(obstacles[i].position.x - snake.body[j].x) <= 2 && 
-                    abs(obstacles[i].position.y - snake.body[j].y) <= 2) {
-                    near_snake = 1;
-                    break;
+            for (int y = obstacles[i].position.y - 2; y <= obstacles[i].position.y + 2; y++) {
+                for (int x = obstacles[i].position.x - 2; x <= obstacles[i].position.x + 2; x++) {
+                    if (y >= 0 && y < GAME_HEIGHT && x >= 0 && x < GAME_WIDTH &&
+                        body_occupies(&snake.body, x, y)) {
+                        near_snake = 1;
+                    }
                 }
             }
             
@@ -488,65 +788,47 @@ void handle_input() {
 int handle_collisions() {
     // Engel çarpışması
     for (int i = 0; i < obstacle_count; i++) {
-        if (snake.body[0].x == obstacles[i].position.x && 
-            snake.body[0].y == obstacles[i].position.y) {
+        if (snake.body.head.x == obstacles[i].position.x && 
+            snake.body.head.y == obstacles[i].position.y) {
             snake.lives--;
             if (snake.lives <= 0) {
                 return 1;  // Oyun bitti
             } else {
                 // Yılanı başlangıç konumuna geri döndür
-                free(snake.body);  // Önceki belleği temizle
-                snake.body = NULL;
+                free(snake.body.links);  // Önceki belleği temizle
+                snake.body.links = NULL;
                 initialize_snake();
                 return 0;
             }
         }
     }
     
-    // Kendi kuyruğuna çarpma kontrolü
-    for (int i = 1; i < snake.length; i++) {
-        if (snake.body[0].x == snake.body[i].x && snake.body[0].y == snake.body[i].y) {
-            snake.lives--;
-            if (snake.lives <= 0) {
-                return 1;  // Oyun bitti
-            } else {
-                // Yılanı başlangıç konumuna geri döndür
-                free(snake.body);  // Önceki belleği temizle
-                snake.body = NULL;
-                initialize_snake();
-                return 0;
-            }
+    // Kendi kuyruğuna çarpma kontrolü (baş dolu bir hücreye mi girdi)
+    if (snake.body.self_hit) {
+        snake.lives--;
+        if (snake.lives <= 0) {
+            return 1;  // Oyun bitti
+        } else {
+            // Yılanı başlangıç konumuna geri döndür
+            free(snake.body.links);  // Önceki belleği temizle
+            snake.body.links = NULL;
+            initialize_snake();
+            return 0;
         }
     }
     
     // Yiyecek yeme kontrolü
     for (int i = 0; i < MAX_FOOD; i++) {
-        if (snake.body[0].x == foods[i].position.x && 
-            snake.body[0].y == foods[i].position.y) {
+        if (snake.body.head.x == foods[i].position.x && 
+            snake.body.head.y == foods[i].position.y) {
             // Puanı artır
             add_score(foods[i].value);
             
-            // Yılanı büyüt
-            if (snake.length < snake.max_length) {
-                // Yılanın sonuna yeni bir segment ekle
-                // Önceki segment pozisyonuyla aynı (sonraki adımda düzeltilecek)
-                snake.body[snake.length] = snake.body[snake.length - 1];
-                snake.length++;
-            } else {
-                // Eğer maksimum uzunluğa ulaşıldıysa, yeni bellek ayır
-                Point *new_body = realloc(snake.body, (snake.max_length * 2) * sizeof(Point));
-                if (new_body == NULL) {
-                    free(snake.body);  // Realloc başarısız olursa eski belleği temizle
-                    endwin();
-                    fprintf(stderr, "Memory allocation error during snake growth\n");
-                    exit(EXIT_FAILURE);
-                }
-                snake.body = new_body;
-                snake.max_length *= 2;
-                // Yeni segmenti ekle
-                snake.body[snake.length] = snake.body[snake.length - 1];
-                snake.length++;
+            // Yılanı büyüt, gerekirse halka tamponu genişlet
+            if (snake.body.length >= snake.body.max_length) {
+                grow_snake_capacity();
             }
+            body_grow(&snake.body);
             
             // Yeni yiyecek oluştur
             spawn_food(i);
@@ -582,16 +864,19 @@ void update_game() {
 }
 
 void draw_game() {
-    
-    
+    profile_begin(PHASE_DRAW);
     draw_background();
     draw_border();
     draw_obstacles();
     draw_foods();
     draw_snake();
     draw_stats();
+    profile_end(PHASE_DRAW);
     
+    // Terminale yazma ayrı ölçülür
+    profile_begin(PHASE_REFRESH);
     refresh();
+    profile_end(PHASE_REFRESH);
 }
 
 void draw_stats() {
@@ -607,6 +892,12 @@ void draw_stats() {
         default: diff_text = "Bilinmiyor";
     }
     printw("Zorluk: %s\n Kontroller: Yön tuşları, P:Duraklat, R:Yeniden başlat, Q:Çıkış", diff_text);
+    
+    // Planlayıcı istatistikleri
+    if (planner.enabled) {
+        mvprintw(GAME_HEIGHT + 2, 1, "Planlayıcı: %d iş parçacığı | %.0f düğüm/sn | Hamle kalitesi: %.1f   ",
+                 planner.thread_count, planner.last_nodes_per_sec, planner.last_quality);
+    }
     attroff(COLOR_PAIR(7));
 }
 
@@ -703,4 +994,616 @@ void add_score(int value) {
             snake.lives++;  // Ekstra can
         }
     }
-}
\ No newline at end of file
+}
+// ---------------------------------------------------------------------------
+// Planlayıcı: oyunun kopyası üzerinde paralel Monte Carlo ileri arama
+// ---------------------------------------------------------------------------
+
+// Planlayıcı kendi rastgele sayı üretecini kullanır, böylece oyunun rand()
+// dizisi bozulmaz ve her kopya kendi durumunu taşır
+unsigned int sim_rand(unsigned int *rng) {
+    unsigned int x = *rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *rng = x;
+    return x;
+}
+
+double elapsed_seconds(struct timespec start, struct timespec end) {
+    return (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+// Canlı oyunun tam kopyasını çıkar
+void sim_clone(SimState *dst) {
+    int links = snake.body.length - 1 - snake.body.growth;
+    
+    // Bağlantılar kopyanın kendi tamponuna kuyruktan itibaren açılır
+    dst->body = snake.body;
+    dst->body.links = dst->link_storage;
+    dst->body.first_link = 0;
+    dst->body.max_length = LINK_WORDS(BOARD_CELLS) * LINKS_PER_WORD;
+    for (int i = 0; i < links; i++) {
+        body_set_link(&dst->body, i, body_link(&snake.body, i));
+    }
+    dst->direction = snake.direction;
+    dst->lives = snake.lives;
+    memcpy(dst->foods, foods, sizeof(foods));
+    memcpy(dst->obstacles, obstacles, sizeof(obstacles));
+    dst->obstacle_count = obstacle_count;
+    dst->score = state.score;
+    dst->level = state.level;
+    dst->difficulty = state.difficulty;
+    // rng: oyunun rand() durumu kopyalanamaz; sim_rollout() her rollout'ta
+    // iş parçacığının kendi xorshift üretecinden yeniden tohumlar
+}
+
+// Kopya sabit boyutludur; sadece links işaretçisi düzeltilmeli
+void sim_copy(SimState *dst, const SimState *src) {
+    *dst = *src;
+    dst->body.links = dst->link_storage;
+}
+
+// initialize_snake() ile aynı başlangıç konumu
+void sim_reset_snake(SimState *s) {
+    s->direction = RIGHT;
+    body_reset(&s->body);
+}
+
+// spawn_food() ile aynı kurallar, kopyanın RNG'si ile
+void sim_spawn_food(SimState *s, int index) {
+    int is_bonus = (sim_rand(&s->rng) % BONUS_FOOD_CHANCE == 0);
+    Food *food = &s->foods[index];
+    
+    do {
+        food->position.x = sim_rand(&s->rng) % (GAME_WIDTH - 4) + 2;
+        food->position.y = sim_rand(&s->rng) % (GAME_HEIGHT - 4) + 2;
+        
+        int taken = body_occupies(&s->body, food->position.x, food->position.y);
+        for (int i = 0; i < s->obstacle_count && !taken; i++) {
+            taken = food->position.x == s->obstacles[i].position.x &&
+                    food->position.y == s->obstacles[i].position.y;
+        }
+        for (int i = 0; i < MAX_FOOD && !taken; i++) {
+            taken = i != index && food->position.x == s->foods[i].position.x &&
+                    food->position.y == s->foods[i].position.y;
+        }
+        
+        if (!taken) break;
+    } while (1);
+    
+    food->is_bonus = is_bonus;
+    food->value = is_bonus ? 30 : 10;
+    food->duration = is_bonus ? BONUS_DURATION : -1;
+    food->symbol = is_bonus ? BONUS_FOOD : NORMAL_FOOD;
+}
+
+// Başın bu noktaya girmesi can kaybettirir mi?
+// Kuyruk ucu bu adımda boşalacağı için sayılmaz
+int sim_is_blocked(const SimState *s, Point p) {
+    for (int i = 0; i < s->obstacle_count; i++) {
+        if (p.x == s->obstacles[i].position.x && p.y == s->obstacles[i].position.y) {
+            return 1;
+        }
+    }
+    if (s->body.growth == 0 && p.x == s->body.tail.x && p.y == s->body.tail.y) {
+        return 0;
+    }
+    return body_occupies(&s->body, p.x, p.y);
+}
+
+// Kopyayı bir tik ilerlet: move_snake(), handle_collisions() ve bonus
+// yiyeceklerin süre sayacı. Dönüş: 0 = devam, 1 = can kaybı, 2 = oyun bitti
+int sim_step(SimState *s, Direction dir) {
+    s->direction = dir;
+    body_advance(&s->body, dir);
+    Point new_head = s->body.head;
+    
+    // Engel ve kuyruk çarpışması
+    int hit = 0;
+    for (int i = 0; i < s->obstacle_count && !hit; i++) {
+        hit = new_head.x == s->obstacles[i].position.x && new_head.y == s->obstacles[i].position.y;
+    }
+    if (s->body.self_hit) {
+        hit = 1;
+    }
+    if (hit) {
+        s->lives--;
+        if (s->lives <= 0) {
+            return 2;
+        }
+        sim_reset_snake(s);
+        return 1;
+    }
+    
+    // Yiyecek yeme
+    for (int i = 0; i < MAX_FOOD; i++) {
+        if (new_head.x == s->foods[i].position.x && new_head.y == s->foods[i].position.y) {
+            s->score += s->foods[i].value;
+            if (s->foods[i].value >= 30 && s->lives < 5) {
+                s->lives++;
+            }
+            
+            if (s->body.length < BOARD_CELLS) {
+                body_grow(&s->body);
+            }
+            
+            sim_spawn_food(s, i);
+            
+            if (s->score >= s->level * 100) {
+                s->level++;
+                if (s->difficulty > EASY && s->obstacle_count < MAX_OBSTACLES) {
+                    s->obstacles[s->obstacle_count].position.x = sim_rand(&s->rng) % (GAME_WIDTH - 4) + 2;
+                    s->obstacles[s->obstacle_count].position.y = sim_rand(&s->rng) % (GAME_HEIGHT - 4) + 2;
+                    s->obstacle_count++;
+                }
+            }
+            break;
+        }
+    }
+    
+    // Bonus yiyeceklerin süresi (draw_foods() içindeki sayaç)
+    for (int i = 0; i < MAX_FOOD; i++) {
+        if (s->foods[i].is_bonus) {
+            if (s->foods[i].duration > 0) {
+                s->foods[i].duration--;
+            } else if (s->foods[i].duration == 0) {
+                sim_spawn_food(s, i);
+            }
+        }
+    }
+    
+    return 0;
+}
+
+// İlk hamle sabit, sonrası rastgele (ölümcül olmayan yönleri tercih eden)
+// bir oyun. Değer: kazanılan puan, can kaybı cezası ve en yakın yiyeceğe
+// uzaklık
+double sim_rollout(SimState *s, Direction first, unsigned int *rng, long *nodes) {
+    int start_score = s->score;
+    int result;
+    int depth = 0;
+    Direction dir = first;
+    
+    s->rng = sim_rand(rng);
+    while (1) {
+        result = sim_step(s, dir);
+        depth++;
+        if (result != 0 || depth >= PLANNER_DEPTH) {
+            break;
+        }
+        
+        // Geri dönüş hariç üç yönden rastgele birini seç, engelliyse sıradakini dene
+        Direction back = opposite_direction(s->direction);
+        int offset = sim_rand(rng) % 4;
+        for (int i = 0; i < 4; i++) {
+            dir = (Direction)((offset + i) % 4);
+            if (dir != back && !sim_is_blocked(s, next_position(s->body.head, dir))) {
+                break;
+            }
+        }
+        if (dir == back) {
+            dir = s->direction;
+        }
+    }
+    *nodes += depth;
+    
+    double value = s->score - start_score;
+    if (result != 0) {
+        // Erken ölüm daha ağır cezalandırılır
+        return value - PLANNER_DEATH_PENALTY * (PLANNER_DEPTH - depth + 1) / PLANNER_DEPTH;
+    }
+    
+    int nearest = GAME_WIDTH + GAME_HEIGHT;
+    for (int i = 0; i < MAX_FOOD; i++) {
+        int distance = abs(s->foods[i].position.x - s->body.head.x) +
+                       abs(s->foods[i].position.y - s->body.head.y);
+        if (distance < nearest) {
+            nearest = distance;
+        }
+    }
+    return value + (GAME_WIDTH + GAME_HEIGHT - nearest) / 10.0;
+}
+
+// Bir tiklik arama: süre dolana kadar adaylar sırayla denenir
+void planner_search(PlannerArena *arena) {
+    struct timespec now;
+    long iteration = 0;
+    
+    // Sayaçlar yerel tutulur, alana sadece arama bitince yazılır
+    double value_sum[4] = {0};
+    long visits[4] = {0};
+    long nodes = 0;
+    unsigned int rng = arena->rng;
+    
+    do {
+        int c = iteration % planner.candidate_count;
+        sim_copy(&arena->work, &planner.root);
+        value_sum[c] += sim_rollout(&arena->work, planner.candidates[c], &rng, &nodes);
+        visits[c]++;
+        iteration++;
+        
+        clock_gettime(CLOCK_MONOTONIC, &now);
+    } while (iteration < planner.candidate_count ||
+             now.tv_sec < planner.deadline.tv_sec ||
+             (now.tv_sec == planner.deadline.tv_sec && now.tv_nsec < planner.deadline.tv_nsec));
+    
+    memcpy(arena->value_sum, value_sum, sizeof(value_sum));
+    memcpy(arena->visits, visits, sizeof(visits));
+    arena->nodes = nodes;
+    arena->rng = rng;
+}
+
+// Yeni nesil gelene kadar bekle, ara, bittiğini bildir
+void *planner_worker(void *arg) {
+    PlannerArena *arena = arg;
+    long seen = 0;
+    
+    while (1) {
+        pthread_mutex_lock(&planner.lock);
+        while (planner.generation == seen && !planner.shutdown) {
+            pthread_cond_wait(&planner.work_ready, &planner.lock);
+        }
+        if (planner.shutdown) {
+            pthread_mutex_unlock(&planner.lock);
+            return NULL;
+        }
+        seen = planner.generation;
+        pthread_mutex_unlock(&planner.lock);
+        
+        planner_search(arena);
+        
+        pthread_mutex_lock(&planner.lock);
+        if (--planner.pending == 0) {
+            pthread_cond_signal(&planner.work_done);
+        }
+        pthread_mutex_unlock(&planner.lock);
+    }
+}
+
+void planner_init() {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    planner.thread_count = cpus < 1 ? 1 : (cpus > PLANNER_MAX_THREADS ? PLANNER_MAX_THREADS : cpus);
+    
+    // sizeof(PlannerArena) 64'ün katı olduğundan aligned_alloc için uygundur
+    planner.arenas = aligned_alloc(_Alignof(PlannerArena), planner.thread_count * sizeof(PlannerArena));
+    if (planner.arenas == NULL) {
+        endwin();
+        fprintf(stderr, "Memory allocation error for planner arenas\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(planner.arenas, 0, planner.thread_count * sizeof(PlannerArena));
+    
+    pthread_mutex_init(&planner.lock, NULL);
+    pthread_cond_init(&planner.work_ready, NULL);
+    pthread_cond_init(&planner.work_done, NULL);
+    planner.generation = 0;
+    planner.pending = 0;
+    planner.shutdown = 0;
+    
+    for (int i = 0; i < planner.thread_count; i++) {
+        PlannerArena *arena = &planner.arenas[i];
+        arena->rng = (unsigned int)time(NULL) ^ (2654435761u * (i + 1));
+        if (pthread_create(&arena->thread, NULL, planner_worker, arena) != 0) {
+            endwin();
+            fprintf(stderr, "Could not start planner thread\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+void planner_cleanup() {
+    if (planner.arenas == NULL) {
+        return;
+    }
+    
+    pthread_mutex_lock(&planner.lock);
+    planner.shutdown = 1;
+    pthread_cond_broadcast(&planner.work_ready);
+    pthread_mutex_unlock(&planner.lock);
+    for (int i = 0; i < planner.thread_count; i++) {
+        pthread_join(planner.arenas[i].thread, NULL);
+    }
+    
+    pthread_cond_destroy(&planner.work_done);
+    pthread_cond_destroy(&planner.work_ready);
+    pthread_mutex_destroy(&planner.lock);
+    free(planner.arenas);
+    planner.arenas = NULL;
+}
+
+// Bir sonraki yönü seç ve snake.next_direction'a yaz.
+// Planlamaya harcanan süreyi mikrosaniye olarak döndürür
+int planner_choose_move() {
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    
+    // Süre bütçesi: tik süresinin belirli bir yüzdesi
+    long budget_ns = (long)snake.speed * 1000 * PLANNER_BUDGET_PERCENT / 100;
+    planner.deadline.tv_sec = start.tv_sec + (start.tv_nsec + budget_ns) / 1000000000L;
+    planner.deadline.tv_nsec = (start.tv_nsec + budget_ns) % 1000000000L;
+    
+    sim_clone(&planner.root);
+    planner.candidate_count = 0;
+    for (int d = UP; d <= RIGHT; d++) {
+        if ((Direction)d != opposite_direction(snake.direction)) {
+            planner.candidates[planner.candidate_count++] = (Direction)d;
+        }
+    }
+    
+    // Bekleyen iş parçacıklarını uyandır ve hepsi bitene kadar bekle
+    pthread_mutex_lock(&planner.lock);
+    planner.pending = planner.thread_count;
+    planner.generation++;
+    pthread_cond_broadcast(&planner.work_ready);
+    while (planner.pending > 0) {
+        pthread_cond_wait(&planner.work_done, &planner.lock);
+    }
+    pthread_mutex_unlock(&planner.lock);
+    
+    double value_sum[3] = {0};
+    long visits[3] = {0};
+    long nodes = 0;
+    for (int i = 0; i < planner.thread_count; i++) {
+        PlannerArena *arena = &planner.arenas[i];
+        for (int c = 0; c < planner.candidate_count; c++) {
+            value_sum[c] += arena->value_sum[c];
+            visits[c] += arena->visits[c];
+        }
+        nodes += arena->nodes;
+    }
+    
+    // En yüksek ortalama değere sahip hamleyi seç
+    int best = 0;
+    for (int c = 1; c < planner.candidate_count; c++) {
+        if (value_sum[c] / visits[c] > value_sum[best] / visits[best]) {
+            best = c;
+        }
+    }
+    snake.next_direction = planner.candidates[best];
+    
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double seconds = elapsed_seconds(start, end);
+    
+    planner.ticks++;
+    planner.total_nodes += nodes;
+    planner.total_seconds += seconds;
+    planner.last_nodes_per_sec = seconds > 0 ? nodes / seconds : 0;
+    planner.last_quality = value_sum[best] / visits[best];
+    planner.quality_sum += planner.last_quality;
+    
+    return (int)(seconds * 1000000);
+}
+
+// Çıkışta özet
+void planner_report() {
+    printf("Planlayıcı özeti\n");
+    printf("  İş parçacığı     : %d\n", planner.thread_count);
+    printf("  Rollout derinliği: %d tik\n", PLANNER_DEPTH);
+    printf("  Planlanan tik    : %ld\n", planner.ticks);
+    printf("  Toplam düğüm     : %ld\n", planner.total_nodes);
+    if (planner.ticks > 0) {
+        printf("  Düğüm/sn         : %.0f\n", planner.total_seconds > 0 ? planner.total_nodes / planner.total_seconds : 0);
+        printf("  Düğüm/tik        : %.0f\n", (double)planner.total_nodes / planner.ticks);
+        printf("  Ort. hamle kalitesi: %.2f\n", planner.quality_sum / planner.ticks);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Profil modu: aşama başına donanım sayaçları (perf_event_open)
+// ---------------------------------------------------------------------------
+
+#ifdef __linux__
+int profile_open_counter(unsigned long long config, int group_fd) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = (group_fd == -1);  // Grup lideri açılınca etkinleştirilir
+    attr.exclude_kernel = 1;           // Yetkisiz süreçler için yeterli
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+    
+    // Sadece ana iş parçacığı (pid = 0) ölçülür, planlayıcı iş parçacıkları hariç
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+#endif
+
+// Sayaçları tek bir grup olarak aç; hiçbiri açılamazsa saat ile devam et
+void profile_init() {
+    profiler.group_fd = -1;
+    profiler.slot_count = 0;
+    profiler.open_error = 0;
+    
+#ifdef __linux__
+    const unsigned long long configs[COUNTER_COUNT] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES
+    };
+    
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        profiler.fds[i] = profile_open_counter(configs[i], profiler.group_fd);
+        if (profiler.fds[i] == -1) {
+            profiler.slots[i] = -1;
+            if (profiler.open_error == 0) {
+                profiler.open_error = errno;
+            }
+            continue;
+        }
+        if (profiler.group_fd == -1) {
+            profiler.group_fd = profiler.fds[i];
+        }
+        profiler.slots[i] = profiler.slot_count++;
+    }
+    
+    if (profiler.group_fd != -1) {
+        ioctl(profiler.group_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(profiler.group_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#else
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        profiler.fds[i] = -1;
+        profiler.slots[i] = -1;
+    }
+    profiler.open_error = ENOSYS;
+#endif
+}
+
+void profile_cleanup() {
+    if (!profiler.enabled) {
+        return;
+    }
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        if (profiler.fds[i] != -1) {
+            close(profiler.fds[i]);
+            profiler.fds[i] = -1;
+        }
+    }
+    profiler.group_fd = -1;
+}
+
+// Tüm grubu tek bir read() ile oku. Biçim: nr, time_enabled, time_running, değerler
+void profile_read(ProfileSample *sample) {
+    unsigned long long buffer[3 + COUNTER_COUNT] = {0};
+    
+    memset(sample, 0, sizeof(*sample));
+    if (profiler.group_fd == -1 ||
+        read(profiler.group_fd, buffer, sizeof(buffer)) < (ssize_t)(3 * sizeof(unsigned long long))) {
+        return;
+    }
+    sample->time_enabled = buffer[1];
+    sample->time_running = buffer[2];
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        sample->values[i] = profiler.slots[i] == -1 ? 0 : buffer[3 + profiler.slots[i]];
+    }
+}
+
+// Planlama iş parçacıklarda yapılır; ana iş parçacığının sayaçları o sırada
+// sadece beklemeyi ölçer, bu yüzden bu aşama için sadece süre tutulur
+int profile_counts_phase(ProfilePhase phase) {
+    return phase != PHASE_PLAN;
+}
+
+void profile_begin(ProfilePhase phase) {
+    if (!profiler.enabled) {
+        return;
+    }
+    if (profile_counts_phase(phase)) {
+        profile_read(&profiler.start_sample);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &profiler.start);
+}
+
+void profile_end(ProfilePhase phase) {
+    if (!profiler.enabled) {
+        return;
+    }
+    
+    struct timespec end;
+    ProfileSample sample;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    
+    PhaseStats *stats = &profiler.phases[phase];
+    stats->calls++;
+    stats->seconds += elapsed_seconds(profiler.start, end);
+    if (!profile_counts_phase(phase)) {
+        return;
+    }
+    
+    profile_read(&sample);
+    unsigned long long enabled = sample.time_enabled - profiler.start_sample.time_enabled;
+    unsigned long long running = sample.time_running - profiler.start_sample.time_running;
+    
+    // Grup bu aralıkta hiç zamanlanmadıysa sıfırlar veri sayılmaz
+    if (running == 0) {
+        return;
+    }
+    
+    // PMU başka olaylarla paylaşıldıysa sayımlar çalışma oranına göre ölçeklenir
+    double scale = 1.0;
+    if (running < enabled) {
+        scale = (double)enabled / running;
+        stats->multiplexed = 1;
+    }
+    stats->sampled++;
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        unsigned long long delta = sample.values[i] - profiler.start_sample.values[i];
+        stats->counters[i] += (unsigned long long)(delta * scale + 0.5);
+    }
+}
+
+// Çıkışta aşama başına özet: süre, IPC ve çağrı başına kaçırmalar
+void profile_report() {
+    const char *names[PHASE_COUNT] = {"plan", "update_game", "draw_game", "refresh"};
+    long ticks = profiler.phases[PHASE_UPDATE].calls;
+    
+    printf("Profil özeti (%ld tik)\n", ticks);
+    if (profiler.slot_count == 0) {
+        printf("  Donanım sayaçları kullanılamıyor (%s), sadece süre ölçüldü\n",
+               strerror(profiler.open_error));
+    } else if (profiler.slot_count < COUNTER_COUNT) {
+        printf("  Bazı sayaçlar açılamadı (%s), eksikler n/a gösterilir\n",
+               strerror(profiler.open_error));
+    }
+    
+    // Grup açıldı ama hiç zamanlanmadıysa (ör. boş PMU sayacı olmayan sanal makineler)
+    // sayaçlar kullanılamaz sayılır
+    int sampled = 0, multiplexed = 0, unsampled = 0;
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        if (!profile_counts_phase(p)) {
+            continue;
+        }
+        sampled += profiler.phases[p].sampled > 0;
+        multiplexed |= profiler.phases[p].multiplexed;
+        unsampled |= profiler.phases[p].sampled < profiler.phases[p].calls;
+    }
+    if (profiler.slot_count > 0 && sampled == 0) {
+        printf("  Sayaçlar açıldı ama hiç zamanlanmadı, sadece süre ölçüldü\n");
+    } else if (profiler.slot_count > 0) {
+        if (multiplexed) {
+            printf("  Sayaçlar çoğullandı, değerler çalışma süresine göre ölçeklendi\n");
+        }
+        if (unsampled) {
+            printf("  Bazı ölçümlerde sayaçlar zamanlanmadı, çağrı başına değerler sadece sayılan çağrılardan\n");
+        }
+    }
+    
+    // Türkçe karakterler printf genişliğini bozduğu için başlık elle hizalı
+    printf("%s\n", "  aşama           çağrı  toplam ms   µs/çağrı         cycles   instructions    IPC  cache-mis/çağrı branch-mis/çağrı");
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        PhaseStats *stats = &profiler.phases[p];
+        if (stats->calls == 0) {
+            continue;
+        }
+        
+        printf("  %-12s %8ld %10.2f %10.1f", names[p], stats->calls,
+               stats->seconds * 1e3, stats->seconds * 1e6 / stats->calls);
+        
+        int counted = profile_counts_phase(p) && stats->sampled > 0;
+        int cycles = counted && profiler.slots[COUNTER_CYCLES] != -1;
+        int instructions = counted && profiler.slots[COUNTER_INSTRUCTIONS] != -1;
+        if (cycles) printf(" %14llu", stats->counters[COUNTER_CYCLES]);
+        else printf(" %14s", "n/a");
+        if (instructions) printf(" %14llu", stats->counters[COUNTER_INSTRUCTIONS]);
+        else printf(" %14s", "n/a");
+        if (cycles && instructions && stats->counters[COUNTER_CYCLES] > 0)
+            printf(" %6.2f", (double)stats->counters[COUNTER_INSTRUCTIONS] / stats->counters[COUNTER_CYCLES]);
+        else printf(" %6s", "n/a");
+        
+        for (int c = COUNTER_CACHE_MISSES; c <= COUNTER_BRANCH_MISSES; c++) {
+            // Çizim duraklatılmış karelerde de çalışır; her aşama kendi (sayılan) çağrı sayısına bölünür
+            if (counted && profiler.slots[c] != -1)
+                printf(" %16.1f", (double)stats->counters[c] / stats->sampled);
+            else printf(" %16s", "n/a");
+        }
+        printf("\n");
+    }
+    
+    if (profiler.phases[PHASE_PLAN].calls > 0 && profiler.slot_count > 0) {
+        printf("  plan: sayaçlar sadece ana iş parçacığını ölçer (bekleme), bu yüzden n/a\n");
+    }
+}